@@ -21,6 +21,24 @@
 #include <ctype.h>
 #include <errno.h>
 
+// SIMD intrinsics for the batch point kernels (scalar fallback below)
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+// C11 threads for the parallel sort mode (serial fallback below)
+#if !defined(__STDC_NO_THREADS__)
+    #include <threads.h>
+#endif
+
+// POSIX headers for the optional mmap read mode of the streaming I/O layer
+#if defined(__unix__) || defined(__APPLE__)
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
 // Preprocessor directives
 #define MAX_SIZE 100
 #define PI 3.14159
@@ -47,6 +65,44 @@
     #define COMPILER "Unknown"
 #endif
 
+// Low-overhead instrumentation: thread-local counters plus tick-based
+// timers behind ENABLE_INSTRUMENTATION; with the flag off, every macro
+// compiles to nothing
+#ifdef ENABLE_INSTRUMENTATION
+typedef struct InstrCounters {
+    uint64_t file_reads;
+    uint64_t file_writes;
+    uint64_t io_ticks;
+} InstrCounters;
+
+// One block per thread (C11 _Thread_local), so increments never contend
+static _Thread_local InstrCounters instr_counters;
+
+static uint64_t instr_read_ticks(void) {
+#if defined(__GNUC__) && defined(__x86_64__)
+    return __builtin_ia32_rdtsc();
+#else
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+#define INSTR_COUNT(field) (instr_counters.field++)
+#define INSTR_TIMER_START(var) uint64_t var = instr_read_ticks()
+#define INSTR_TIMER_STOP(var) (instr_counters.io_ticks += instr_read_ticks() - (var))
+#define INSTR_REPORT() \
+    printf("[instr] file_reads=%llu file_writes=%llu io_ticks=%llu\n", \
+           (unsigned long long)instr_counters.file_reads, \
+           (unsigned long long)instr_counters.file_writes, \
+           (unsigned long long)instr_counters.io_ticks)
+#else
+#define INSTR_COUNT(field)
+#define INSTR_TIMER_START(var)
+#define INSTR_TIMER_STOP(var)
+#define INSTR_REPORT()
+#endif
+
 // Constants
 const int GLOBAL_CONSTANT = 42;
 const char* PROGRAM_NAME = "C Syntax Test";
@@ -66,6 +122,11 @@ typedef enum Status Status;
 typedef int (*FunctionPtr)(int, int);
 typedef void (*CallbackPtr)(const char*);
 
+// Callbacks for the chunked parallel file pipeline: chunk_fn reduces one
+// block of bytes to a value, merge_fn folds chunk results in file order
+typedef uint64_t (*FileChunkFn)(const char* data, size_t length);
+typedef uint64_t (*FileMergeFn)(uint64_t accumulated, uint64_t chunk_result);
+
 // Enum definitions
 enum Color {
     RED,
@@ -107,6 +168,130 @@ union Number {
     char bytes[8];
 };
 
+// Structure-of-arrays batch of points: separate x/y arrays keep SIMD lanes
+// dense, unlike an array of struct Point where the label padding interleaves
+typedef struct PointBatch {
+    double* xs;
+    double* ys;
+    size_t count;
+} PointBatch;
+
+// Versioned, pointer-free binary snapshot of a Person list: records link by
+// 32-bit index instead of pointer, so a snapshot written once can later be
+// mmap'ed and walked in place with zero parsing or per-record allocation
+#define PERSON_SNAPSHOT_MAGIC 0x50534E50u   /* "PNSP" */
+#define PERSON_SNAPSHOT_VERSION 1u
+#define PERSON_SNAPSHOT_NIL UINT32_MAX
+
+typedef struct PersonSnapshotHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t record_count;
+    uint32_t reserved;     // Keeps the records 8-byte aligned
+} PersonSnapshotHeader;
+
+// Fixed-size on-disk record; the in-memory layout IS the file layout
+typedef struct PersonRecord {
+    char name[50];
+    char email[100];
+    int32_t age;
+    int32_t status;
+    double x;
+    double y;
+    uint32_t next_index;   // PERSON_SNAPSHOT_NIL ends the chain
+    uint32_t record_pad;
+} PersonRecord;
+
+typedef struct PersonSnapshot {
+    const PersonSnapshotHeader* header;
+    const PersonRecord* records;
+    void* base;            // Mapping base, or heap buffer on the fallback path
+    size_t size;
+    bool mapped;
+} PersonSnapshot;
+
+// String interning: an FNV-1a hashed table hands out stable 32-bit IDs, so
+// the handful of distinct name/email strings are stored once and per-record
+// storage shrinks to two IDs; equality checks become integer compares
+#define INTERN_BUCKETS 256
+#define INTERN_INVALID_ID UINT32_MAX
+
+typedef struct InternEntry {
+    char* text;
+    uint32_t id;
+    struct InternEntry* next;
+} InternEntry;
+
+typedef struct InternTable {
+    InternEntry* buckets[INTERN_BUCKETS];
+    InternEntry** by_id;       // id -> entry, for reverse lookup
+    uint32_t count;
+    uint32_t by_id_capacity;
+} InternTable;
+
+// Person variant storing interned IDs instead of per-record char buffers
+typedef struct CompactPerson {
+    uint32_t name_id;
+    uint32_t email_id;
+    int age;
+    Status status;
+} CompactPerson;
+
+// Pool-backed Person storage: nodes live in one contiguous slab so list
+// traversal walks warm cache lines, and links are 32-bit slab indices
+// instead of 64-bit heap pointers — half the link size, and stable across
+// slab growth (the slab may move, indices do not)
+#define PERSON_POOL_NIL UINT32_MAX
+
+typedef struct PooledPerson {
+    char name[50];
+    int age;
+    char email[100];
+    Status status;
+    struct Point location;
+    uint32_t next_index;   // PERSON_POOL_NIL terminates the chain
+} PooledPerson;
+
+typedef struct PersonPool {
+    PooledPerson* nodes;   // Contiguous slab, grown geometrically
+    uint32_t count;
+    uint32_t capacity;
+} PersonPool;
+
+// Streaming I/O layer: a large user-controlled buffer replaces line-at-a-time
+// stdio calls, and next_line() hands out zero-copy slices into that buffer
+typedef struct StreamReader {
+    FILE* file;          // NULL in mmap mode
+    char* buffer;        // Heap buffer, or the mapped file itself
+    size_t buffer_size;
+    size_t data_len;     // Valid bytes currently in the buffer
+    size_t pos;          // Read cursor within the buffer
+    bool eof;
+    bool mapped;         // Buffer is an mmap'ed file, not owned heap memory
+} StreamReader;
+
+// A borrowed line: points into the reader's buffer and is NOT NUL-terminated;
+// valid until the next call to stream_reader_next_line
+typedef struct LineSlice {
+    const char* data;
+    size_t length;
+} LineSlice;
+
+typedef struct StreamWriter {
+    FILE* file;
+    char* buffer;
+    size_t buffer_size;
+    size_t pos;
+} StreamWriter;
+
+// Arena (bump) allocator: objects are carved out of one block and the
+// whole batch is freed in O(1) by resetting the offset
+typedef struct Arena {
+    unsigned char* base;
+    size_t capacity;
+    size_t offset;
+} Arena;
+
 // Bit fields
 struct Flags {
     unsigned int flag1 : 1;
@@ -120,22 +305,71 @@ struct Flags {
 void print_banner(void);
 int add_numbers(int a, int b);
 double calculate_distance(Point p1, Point p2);
+int point_batch_init(PointBatch* batch, size_t count);
+void point_batch_destroy(PointBatch* batch);
+void add_batch(const PointBatch* a, const PointBatch* b, PointBatch* out);
+void distance_batch(const PointBatch* a, const PointBatch* b, double* out);
 Person* create_person(const char* name, int age, const char* email);
 void free_person(Person* person);
+int arena_init(Arena* arena, size_t capacity);
+void* arena_alloc(Arena* arena, size_t size);
+void arena_reset(Arena* arena);
+void arena_destroy(Arena* arena);
+Person* create_person_in(Arena* arena, const char* name, int age, const char* email);
+int person_pool_init(PersonPool* pool, uint32_t initial_capacity);
+uint32_t person_pool_create(PersonPool* pool, const char* name, int age, const char* email);
+PooledPerson* person_pool_get(PersonPool* pool, uint32_t index);
+void person_pool_destroy(PersonPool* pool);
+void intern_table_init(InternTable* table);
+uint32_t intern_string(InternTable* table, const char* text);
+const char* intern_lookup(const InternTable* table, uint32_t id);
+void intern_table_destroy(InternTable* table);
+CompactPerson create_compact_person(InternTable* table, const char* name, int age, const char* email);
+int person_snapshot_write(const Person* head, const char* path);
+int person_snapshot_open(PersonSnapshot* snapshot, const char* path);
+void person_snapshot_close(PersonSnapshot* snapshot);
 void print_person(const Person* person);
 int compare_persons_by_age(const void* a, const void* b);
+void sort_persons_by_age(Person* persons, size_t n);
 void demonstrate_arrays(void);
 void demonstrate_strings(void);
 void demonstrate_pointers(void);
 void demonstrate_control_flow(void);
 void demonstrate_functions(void);
 void demonstrate_file_operations(void);
+int stream_reader_open(StreamReader* reader, const char* path, size_t buffer_size);
+int stream_reader_open_mapped(StreamReader* reader, const char* path);
+bool stream_reader_next_line(StreamReader* reader, LineSlice* line);
+void stream_reader_close(StreamReader* reader);
+int stream_writer_open(StreamWriter* writer, const char* path, size_t buffer_size);
+int stream_writer_write(StreamWriter* writer, const void* data, size_t length);
+int stream_writer_flush(StreamWriter* writer);
+void stream_writer_close(StreamWriter* writer);
+int process_file_parallel(const char* path, FileChunkFn chunk_fn, FileMergeFn merge_fn, uint64_t* out_result);
+uint64_t count_newlines_chunk(const char* data, size_t length);
+uint64_t sum_chunk_results(uint64_t accumulated, uint64_t chunk_result);
 char* safe_string_copy(char* dest, const char* src, size_t dest_size);
+size_t string_copy_len(char* dest, const char* src, size_t dest_size);
+
+// Stack-buffer overload: sizeof deduces the capacity from the array at
+// compile time, so the size argument can never go stale
+#define STRING_COPY_BUF(dest_array, src) \
+    string_copy_len((dest_array), (src), sizeof(dest_array))
+
+size_t string_copy_memccpy(char* dest, const char* src, size_t dest_size);
 int fibonacci(int n);
+uint64_t fibonacci_iterative(int n);
+uint64_t fibonacci_fast(int n);
 int factorial(int n);
 void bubble_sort(int arr[], int n);
+void hybrid_sort(int arr[], int n);
+void sort_parallel(int arr[], int n, int n_threads);
 void callback_example(CallbackPtr callback);
 void sample_callback(const char* message);
+void print_matrix(int rows, int cols, int matrix[rows][cols]);
+void matrix_transpose_blocked(int rows, int cols, int src[rows][cols], int dst[cols][rows]);
+void matrix_multiply_blocked(int n, int m, int p, int a[n][m], int b[m][p], int c[n][p]);
+void matrix_multiply_parallel(int n, int m, int p, int a[n][m], int b[m][p], int c[n][p], int n_threads);
 
 // Function implementations
 void print_banner(void) {
@@ -155,6 +389,349 @@ double calculate_distance(Point p1, Point p2) {
     return sqrt(dx * dx + dy * dy);
 }
 
+// Serializes a populated list into the snapshot format: header followed by
+// fixed-size records chained through next_index
+int person_snapshot_write(const Person* head, const char* path) {
+    uint32_t count = 0;
+    for (const Person* node = head; node != NULL; node = node->next) {
+        count++;
+    }
+
+    FILE* file = fopen(path, "wb");
+    if (file == NULL) {
+        return -1;
+    }
+
+    PersonSnapshotHeader header = {
+        PERSON_SNAPSHOT_MAGIC, PERSON_SNAPSHOT_VERSION, count, 0
+    };
+    if (fwrite(&header, sizeof(header), 1, file) != 1) {
+        fclose(file);
+        return -1;
+    }
+
+    uint32_t index = 0;
+    for (const Person* node = head; node != NULL; node = node->next, index++) {
+        PersonRecord record;
+        memset(&record, 0, sizeof(record));
+        safe_string_copy(record.name, node->name, sizeof(record.name));
+        safe_string_copy(record.email, node->email, sizeof(record.email));
+        record.age = node->age;
+        record.status = (int32_t)node->status;
+        record.x = node->location.x;
+        record.y = node->location.y;
+        record.next_index = (node->next != NULL) ? index + 1 : PERSON_SNAPSHOT_NIL;
+        record.record_pad = 0;
+
+        if (fwrite(&record, sizeof(record), 1, file) != 1) {
+            fclose(file);
+            return -1;
+        }
+    }
+
+    return (fclose(file) == 0) ? 0 : -1;
+}
+
+// Opens a snapshot for in-place use: mmap on POSIX (instant, zero
+// deserialization), a single bulk read elsewhere
+int person_snapshot_open(PersonSnapshot* snapshot, const char* path) {
+    memset(snapshot, 0, sizeof(*snapshot));
+
+#if defined(__unix__) || defined(__APPLE__)
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(PersonSnapshotHeader)) {
+        close(fd);
+        return -1;
+    }
+
+    void* base = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return -1;
+    }
+    snapshot->base = base;
+    snapshot->size = (size_t)info.st_size;
+    snapshot->mapped = true;
+#else
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        return -1;
+    }
+    fseek(file, 0, SEEK_END);
+    long file_size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (file_size < (long)sizeof(PersonSnapshotHeader)) {
+        fclose(file);
+        return -1;
+    }
+    snapshot->base = malloc((size_t)file_size);
+    if (snapshot->base == NULL ||
+        fread(snapshot->base, 1, (size_t)file_size, file) != (size_t)file_size) {
+        free(snapshot->base);
+        fclose(file);
+        return -1;
+    }
+    fclose(file);
+    snapshot->size = (size_t)file_size;
+    snapshot->mapped = false;
+#endif
+
+    snapshot->header = (const PersonSnapshotHeader*)snapshot->base;
+    if (snapshot->header->magic != PERSON_SNAPSHOT_MAGIC ||
+        snapshot->header->version != PERSON_SNAPSHOT_VERSION ||
+        snapshot->size < sizeof(PersonSnapshotHeader) +
+            (size_t)snapshot->header->record_count * sizeof(PersonRecord)) {
+        person_snapshot_close(snapshot);
+        return -1;
+    }
+    snapshot->records =
+        (const PersonRecord*)((const unsigned char*)snapshot->base +
+                              sizeof(PersonSnapshotHeader));
+    return 0;
+}
+
+void person_snapshot_close(PersonSnapshot* snapshot) {
+    if (snapshot->base != NULL) {
+        if (snapshot->mapped) {
+#if defined(__unix__) || defined(__APPLE__)
+            munmap(snapshot->base, snapshot->size);
+#endif
+        } else {
+            free(snapshot->base);
+        }
+    }
+    memset(snapshot, 0, sizeof(*snapshot));
+}
+
+void intern_table_init(InternTable* table) {
+    memset(table->buckets, 0, sizeof(table->buckets));
+    table->by_id = NULL;
+    table->count = 0;
+    table->by_id_capacity = 0;
+}
+
+static uint32_t fnv1a_hash(const char* text) {
+    uint32_t hash = 2166136261u;
+    while (*text != '\0') {
+        hash ^= (unsigned char)*text++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Returns the existing ID for a known string, or copies it in and assigns
+// the next one; INTERN_INVALID_ID on allocation failure
+uint32_t intern_string(InternTable* table, const char* text) {
+    if (table == NULL || text == NULL) {
+        return INTERN_INVALID_ID;
+    }
+
+    uint32_t bucket = fnv1a_hash(text) % INTERN_BUCKETS;
+    for (InternEntry* entry = table->buckets[bucket]; entry != NULL; entry = entry->next) {
+        if (strcmp(entry->text, text) == 0) {
+            return entry->id;
+        }
+    }
+
+    if (table->count == table->by_id_capacity) {
+        uint32_t new_capacity = (table->by_id_capacity == 0) ? 16 : table->by_id_capacity * 2;
+        InternEntry** grown =
+            (InternEntry**)realloc(table->by_id, new_capacity * sizeof(InternEntry*));
+        if (grown == NULL) {
+            return INTERN_INVALID_ID;
+        }
+        table->by_id = grown;
+        table->by_id_capacity = new_capacity;
+    }
+
+    InternEntry* entry = (InternEntry*)malloc(sizeof(InternEntry));
+    if (entry == NULL) {
+        return INTERN_INVALID_ID;
+    }
+    size_t length = strlen(text);
+    entry->text = (char*)malloc(length + 1);
+    if (entry->text == NULL) {
+        free(entry);
+        return INTERN_INVALID_ID;
+    }
+    memcpy(entry->text, text, length + 1);
+
+    entry->id = table->count;
+    entry->next = table->buckets[bucket];
+    table->buckets[bucket] = entry;
+    table->by_id[table->count] = entry;
+    table->count++;
+
+    return entry->id;
+}
+
+const char* intern_lookup(const InternTable* table, uint32_t id) {
+    if (table == NULL || id >= table->count) {
+        return NULL;
+    }
+    return table->by_id[id]->text;
+}
+
+void intern_table_destroy(InternTable* table) {
+    for (size_t i = 0; i < INTERN_BUCKETS; i++) {
+        InternEntry* entry = table->buckets[i];
+        while (entry != NULL) {
+            InternEntry* next = entry->next;
+            free(entry->text);
+            free(entry);
+            entry = next;
+        }
+        table->buckets[i] = NULL;
+    }
+    free(table->by_id);
+    table->by_id = NULL;
+    table->count = 0;
+    table->by_id_capacity = 0;
+}
+
+// Interned counterpart of create_person: no per-record string buffers,
+// just two 32-bit IDs into the shared table
+CompactPerson create_compact_person(InternTable* table, const char* name,
+                                    int age, const char* email) {
+    CompactPerson person;
+    person.name_id = intern_string(table, name);
+    person.email_id = intern_string(table, email);
+    person.age = age;
+    person.status = STATUS_ACTIVE;
+    return person;
+}
+
+int person_pool_init(PersonPool* pool, uint32_t initial_capacity) {
+    if (initial_capacity == 0) {
+        initial_capacity = 16;
+    }
+    pool->nodes = (PooledPerson*)malloc(initial_capacity * sizeof(PooledPerson));
+    if (pool->nodes == NULL) {
+        pool->count = 0;
+        pool->capacity = 0;
+        return -1;
+    }
+    pool->count = 0;
+    pool->capacity = initial_capacity;
+    return 0;
+}
+
+// Pool-backed counterpart of create_person: returns a slab index, not a
+// pointer, so callers stay valid when the slab grows and moves
+uint32_t person_pool_create(PersonPool* pool, const char* name, int age, const char* email) {
+    if (pool == NULL || name == NULL || email == NULL) {
+        return PERSON_POOL_NIL;
+    }
+
+    if (pool->count == pool->capacity) {
+        uint32_t new_capacity = pool->capacity * 2;
+        PooledPerson* grown =
+            (PooledPerson*)realloc(pool->nodes, new_capacity * sizeof(PooledPerson));
+        if (grown == NULL) {
+            return PERSON_POOL_NIL;
+        }
+        pool->nodes = grown;
+        pool->capacity = new_capacity;
+    }
+
+    PooledPerson* node = &pool->nodes[pool->count];
+
+    strncpy(node->name, name, sizeof(node->name) - 1);
+    node->name[sizeof(node->name) - 1] = '\0';
+
+    node->age = age;
+
+    strncpy(node->email, email, sizeof(node->email) - 1);
+    node->email[sizeof(node->email) - 1] = '\0';
+
+    node->status = STATUS_ACTIVE;
+    node->location.x = 0.0;
+    node->location.y = 0.0;
+    strcpy(node->location.label, "Origin");
+    node->next_index = PERSON_POOL_NIL;
+
+    return pool->count++;
+}
+
+PooledPerson* person_pool_get(PersonPool* pool, uint32_t index) {
+    if (pool == NULL || index >= pool->count) {
+        return NULL;
+    }
+    return &pool->nodes[index];
+}
+
+// One free releases every node; no list walk needed
+void person_pool_destroy(PersonPool* pool) {
+    free(pool->nodes);
+    pool->nodes = NULL;
+    pool->count = 0;
+    pool->capacity = 0;
+}
+
+int point_batch_init(PointBatch* batch, size_t count) {
+    batch->xs = (double*)malloc(count * sizeof(double));
+    batch->ys = (double*)malloc(count * sizeof(double));
+    if (batch->xs == NULL || batch->ys == NULL) {
+        free(batch->xs);
+        free(batch->ys);
+        batch->xs = NULL;
+        batch->ys = NULL;
+        batch->count = 0;
+        return -1;
+    }
+    batch->count = count;
+    return 0;
+}
+
+void point_batch_destroy(PointBatch* batch) {
+    free(batch->xs);
+    free(batch->ys);
+    batch->xs = NULL;
+    batch->ys = NULL;
+    batch->count = 0;
+}
+
+// Batch equivalent of Point addition: out[i] = a[i] + b[i]
+void add_batch(const PointBatch* a, const PointBatch* b, PointBatch* out) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    // Two doubles per 128-bit lane; the scalar loop below handles the tail
+    for (; i + 2 <= a->count; i += 2) {
+        _mm_storeu_pd(out->xs + i, _mm_add_pd(_mm_loadu_pd(a->xs + i),
+                                              _mm_loadu_pd(b->xs + i)));
+        _mm_storeu_pd(out->ys + i, _mm_add_pd(_mm_loadu_pd(a->ys + i),
+                                              _mm_loadu_pd(b->ys + i)));
+    }
+#endif
+    for (; i < a->count; i++) {
+        out->xs[i] = a->xs[i] + b->xs[i];
+        out->ys[i] = a->ys[i] + b->ys[i];
+    }
+}
+
+// Batch equivalent of calculate_distance: out[i] = |a[i] - b[i]|
+void distance_batch(const PointBatch* a, const PointBatch* b, double* out) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 2 <= a->count; i += 2) {
+        __m128d dx = _mm_sub_pd(_mm_loadu_pd(a->xs + i), _mm_loadu_pd(b->xs + i));
+        __m128d dy = _mm_sub_pd(_mm_loadu_pd(a->ys + i), _mm_loadu_pd(b->ys + i));
+        __m128d sum = _mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy));
+        _mm_storeu_pd(out + i, _mm_sqrt_pd(sum));
+    }
+#endif
+    for (; i < a->count; i++) {
+        double dx = a->xs[i] - b->xs[i];
+        double dy = a->ys[i] - b->ys[i];
+        out[i] = sqrt(dx * dx + dy * dy);
+    }
+}
+
 Person* create_person(const char* name, int age, const char* email) {
     if (name == NULL || email == NULL) {
         return NULL;
@@ -190,6 +767,69 @@ void free_person(Person* person) {
     }
 }
 
+int arena_init(Arena* arena, size_t capacity) {
+    arena->base = (unsigned char*)malloc(capacity);
+    if (arena->base == NULL) {
+        return -1;
+    }
+    arena->capacity = capacity;
+    arena->offset = 0;
+    return 0;
+}
+
+void* arena_alloc(Arena* arena, size_t size) {
+    // Round the offset up to 8 bytes so any object type is aligned
+    size_t aligned = (arena->offset + 7) & ~(size_t)7;
+    if (aligned + size > arena->capacity) {
+        return NULL;
+    }
+    void* result = arena->base + aligned;
+    arena->offset = aligned + size;
+    return result;
+}
+
+void arena_reset(Arena* arena) {
+    // O(1) batch free: every object allocated from the arena is invalidated
+    arena->offset = 0;
+}
+
+void arena_destroy(Arena* arena) {
+    free(arena->base);
+    arena->base = NULL;
+    arena->capacity = 0;
+    arena->offset = 0;
+}
+
+// Arena-backed variant of create_person: the node lives in the arena, so a
+// whole list is released by arena_reset instead of walking it with free_person
+Person* create_person_in(Arena* arena, const char* name, int age, const char* email) {
+    if (arena == NULL || name == NULL || email == NULL) {
+        return NULL;
+    }
+
+    Person* person = (Person*)arena_alloc(arena, sizeof(Person));
+    if (person == NULL) {
+        fprintf(stderr, "Arena exhausted\n");
+        return NULL;
+    }
+
+    strncpy(person->name, name, sizeof(person->name) - 1);
+    person->name[sizeof(person->name) - 1] = '\0';
+
+    person->age = age;
+
+    strncpy(person->email, email, sizeof(person->email) - 1);
+    person->email[sizeof(person->email) - 1] = '\0';
+
+    person->status = STATUS_ACTIVE;
+    person->location.x = 0.0;
+    person->location.y = 0.0;
+    strcpy(person->location.label, "Origin");
+    person->next = NULL;
+
+    return person;
+}
+
 void print_person(const Person* person) {
     if (person == NULL) {
         printf("Person is NULL\n");
@@ -211,6 +851,74 @@ int compare_persons_by_age(const void* a, const void* b) {
     return person_a->age - person_b->age;
 }
 
+// Branchless LSD radix sort over 64-bit keys: eight counting passes, one
+// byte per pass, ping-ponging between the two buffers (even pass count, so
+// the result lands back in keys)
+static void radix_sort_u64(uint64_t* keys, uint64_t* scratch, size_t n) {
+    uint64_t* from = keys;
+    uint64_t* to = scratch;
+
+    for (int shift = 0; shift < 64; shift += 8) {
+        size_t counts[256] = {0};
+        for (size_t i = 0; i < n; i++) {
+            counts[(from[i] >> shift) & 0xFF]++;
+        }
+
+        size_t total = 0;
+        for (int b = 0; b < 256; b++) {
+            size_t c = counts[b];
+            counts[b] = total;
+            total += c;
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            to[counts[(from[i] >> shift) & 0xFF]++] = from[i];
+        }
+
+        uint64_t* swap = from;
+        from = to;
+        to = swap;
+    }
+}
+
+// Key-extraction sort: instead of qsort's uninlinable void-pointer
+// comparator touching full ~230-byte Person records, each element shrinks
+// to an 8-byte (age, index) key, the keys radix-sort comparator-free, and
+// the permutation is applied to the records in one pass
+void sort_persons_by_age(Person* persons, size_t n) {
+    if (n < 2) {
+        return;
+    }
+
+    uint64_t* keys = (uint64_t*)malloc(n * sizeof(uint64_t));
+    uint64_t* scratch = (uint64_t*)malloc(n * sizeof(uint64_t));
+    Person* reordered = (Person*)malloc(n * sizeof(Person));
+    if (keys == NULL || scratch == NULL || reordered == NULL) {
+        free(keys);
+        free(scratch);
+        free(reordered);
+        qsort(persons, n, sizeof(Person), compare_persons_by_age);
+        return;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        // Flip the sign bit so negative ages order correctly as unsigned
+        uint32_t biased_age = (uint32_t)persons[i].age ^ 0x80000000u;
+        keys[i] = ((uint64_t)biased_age << 32) | (uint32_t)i;
+    }
+
+    radix_sort_u64(keys, scratch, n);
+
+    for (size_t i = 0; i < n; i++) {
+        reordered[i] = persons[keys[i] & 0xFFFFFFFFu];
+    }
+    memcpy(persons, reordered, n * sizeof(Person));
+
+    free(keys);
+    free(scratch);
+    free(reordered);
+}
+
 void demonstrate_arrays(void) {
     printf("\n--- Array Demonstration ---\n");
     
@@ -248,6 +956,15 @@ void demonstrate_arrays(void) {
         printf("\n");
     }
     
+    // Cache-blocked matrix kernels on the same row-major layout
+    int identity[3][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+    int product[3][3];
+    int transposed[3][3];
+    matrix_multiply_blocked(3, 3, 3, matrix, identity, product);
+    matrix_transpose_blocked(3, 3, product, transposed);
+    printf("Matrix x identity, transposed:\n");
+    print_matrix(3, 3, transposed);
+
     printf("Days of the week:\n");
     for (size_t i = 0; i < sizeof(days) / sizeof(days[0]); i++) {
         printf("  %zu: %s\n", i + 1, days[i]);
@@ -293,6 +1010,13 @@ void demonstrate_strings(void) {
     printf("Is uppercase: %s\n", isupper(ch) ? "Yes" : "No");
     printf("Lowercase: %c\n", tolower(ch));
     
+    // Length-returning copies: no strlen follow-up on the result
+    char copy_buffer[32];
+    size_t copied = STRING_COPY_BUF(copy_buffer, "single-pass copy");
+    printf("Copied %zu bytes: %s\n", copied, copy_buffer);
+    copied = string_copy_memccpy(copy_buffer, "memccpy-based copy", sizeof(copy_buffer));
+    printf("Copied %zu bytes: %s\n", copied, copy_buffer);
+
     // String parsing
     char numbers_str[] = "123 456 789";
     char* token = strtok(numbers_str, " ");
@@ -463,6 +1187,44 @@ int fibonacci(int n) {
     return fibonacci(n - 1) + fibonacci(n - 2);
 }
 
+// Iterative O(n) fibonacci; fibonacci(94) is the first value that
+// overflows 64 bits, so anything above 93 returns 0
+uint64_t fibonacci_iterative(int n) {
+    if (n < 0 || n > 93) {
+        return 0;
+    }
+
+    uint64_t previous = 0;
+    uint64_t current = 1;
+    for (int i = 0; i < n; i++) {
+        uint64_t next = previous + current;
+        previous = current;
+        current = next;
+    }
+    return previous;
+}
+
+// Table-backed fast path: all 94 representable values are generated once
+// into a static table, so common calls are a single array load
+uint64_t fibonacci_fast(int n) {
+    static uint64_t table[94];
+    static bool table_ready = false;
+
+    if (!table_ready) {
+        table[0] = 0;
+        table[1] = 1;
+        for (int i = 2; i < 94; i++) {
+            table[i] = table[i - 1] + table[i - 2];
+        }
+        table_ready = true;
+    }
+
+    if (n < 0 || n > 93) {
+        return 0;
+    }
+    return table[n];
+}
+
 int factorial(int n) {
     if (n <= 1) {
         return 1;
@@ -483,6 +1245,195 @@ void bubble_sort(int arr[], int n) {
     }
 }
 
+// --- Hybrid introsort replacement for bubble_sort ---
+
+static void swap_ints(int* a, int* b) {
+    int temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+static void insertion_sort(int a[], int n) {
+    for (int i = 1; i < n; i++) {
+        int key = a[i];
+        int j = i - 1;
+        while (j >= 0 && a[j] > key) {
+            a[j + 1] = a[j];
+            j--;
+        }
+        a[j + 1] = key;
+    }
+}
+
+static void heap_sift_down(int a[], int n, int root) {
+    while (1) {
+        int child = 2 * root + 1;
+        if (child >= n) {
+            break;
+        }
+        if (child + 1 < n && a[child + 1] > a[child]) {
+            child++;
+        }
+        if (a[root] >= a[child]) {
+            break;
+        }
+        swap_ints(&a[root], &a[child]);
+        root = child;
+    }
+}
+
+static void heap_sort(int a[], int n) {
+    for (int i = n / 2 - 1; i >= 0; i--) {
+        heap_sift_down(a, n, i);
+    }
+    for (int i = n - 1; i > 0; i--) {
+        swap_ints(&a[0], &a[i]);
+        heap_sift_down(a, i, 0);
+    }
+}
+
+// Median-of-three pivot selection, then Lomuto partition
+static int partition_range(int a[], int low, int high) {
+    int mid = low + (high - low) / 2;
+    if (a[mid] < a[low]) swap_ints(&a[mid], &a[low]);
+    if (a[high] < a[low]) swap_ints(&a[high], &a[low]);
+    if (a[high] < a[mid]) swap_ints(&a[high], &a[mid]);
+    swap_ints(&a[mid], &a[high]);
+
+    int pivot = a[high];
+    int store = low;
+    for (int i = low; i < high; i++) {
+        if (a[i] < pivot) {
+            swap_ints(&a[i], &a[store]);
+            store++;
+        }
+    }
+    swap_ints(&a[store], &a[high]);
+    return store;
+}
+
+static void introsort_loop(int a[], int low, int high, int depth_limit) {
+    while (high - low > 16) {
+        if (depth_limit == 0) {
+            // Pathological pivots: fall back to heapsort for O(n log n)
+            heap_sort(a + low, high - low + 1);
+            return;
+        }
+        depth_limit--;
+
+        int p = partition_range(a, low, high);
+        // Recurse into the smaller side, loop on the larger one,
+        // so stack depth stays O(log n)
+        if (p - low < high - p) {
+            introsort_loop(a, low, p - 1, depth_limit);
+            low = p + 1;
+        } else {
+            introsort_loop(a, p + 1, high, depth_limit);
+            high = p - 1;
+        }
+    }
+}
+
+// Drop-in O(n log n) replacement for bubble_sort: quicksort with
+// median-of-three pivots, heapsort past a depth limit, and a final
+// insertion pass that finishes the small partitions
+void hybrid_sort(int arr[], int n) {
+    if (n < 2) {
+        return;
+    }
+
+    int depth_limit = 0;
+    for (int m = n; m > 0; m >>= 1) {
+        depth_limit += 2;   // ~2 * log2(n)
+    }
+
+    introsort_loop(arr, 0, n - 1, depth_limit);
+    insertion_sort(arr, n);
+}
+
+// --- Parallel sort mode ---
+
+#define SORT_PARALLEL_THRESHOLD 4096
+#define SORT_MAX_THREADS 64
+
+typedef struct SortJob {
+    int* arr;
+    int low;
+    int high;
+} SortJob;
+
+static int sort_job_run(void* arg) {
+    SortJob* job = (SortJob*)arg;
+    hybrid_sort(job->arr + job->low, job->high - job->low + 1);
+    return 0;
+}
+
+static void merge_runs(int a[], int temp[], int left, int mid, int right) {
+    int i = left;
+    int j = mid + 1;
+    int k = left;
+
+    while (i <= mid && j <= right) {
+        temp[k++] = (a[i] <= a[j]) ? a[i++] : a[j++];
+    }
+    while (i <= mid) {
+        temp[k++] = a[i++];
+    }
+    while (j <= right) {
+        temp[k++] = a[j++];
+    }
+    memcpy(a + left, temp + left, (size_t)(right - left + 1) * sizeof(int));
+}
+
+// Partitions the array across worker threads (each runs hybrid_sort on
+// its chunk), then merges the sorted runs; small arrays and builds
+// without C11 threads sort serially
+void sort_parallel(int arr[], int n, int n_threads) {
+#if defined(__STDC_NO_THREADS__)
+    (void)n_threads;
+    hybrid_sort(arr, n);
+#else
+    if (n < SORT_PARALLEL_THRESHOLD || n_threads < 2) {
+        hybrid_sort(arr, n);
+        return;
+    }
+    if (n_threads > SORT_MAX_THREADS) {
+        n_threads = SORT_MAX_THREADS;
+    }
+
+    SortJob jobs[SORT_MAX_THREADS];
+    thrd_t threads[SORT_MAX_THREADS];
+    bool started[SORT_MAX_THREADS];
+    int chunk = n / n_threads;
+
+    for (int i = 0; i < n_threads; i++) {
+        jobs[i].arr = arr;
+        jobs[i].low = i * chunk;
+        jobs[i].high = (i == n_threads - 1) ? n - 1 : (i + 1) * chunk - 1;
+        started[i] = (thrd_create(&threads[i], sort_job_run, &jobs[i]) == thrd_success);
+        if (!started[i]) {
+            sort_job_run(&jobs[i]);   // Worker unavailable: sort inline
+        }
+    }
+
+    for (int i = 0; i < n_threads; i++) {
+        if (started[i]) {
+            thrd_join(threads[i], NULL);
+        }
+    }
+
+    int* temp = (int*)malloc((size_t)n * sizeof(int));
+    if (temp == NULL) {
+        hybrid_sort(arr, n);   // No merge buffer: sort in place instead
+        return;
+    }
+    for (int i = 1; i < n_threads; i++) {
+        merge_runs(arr, temp, 0, jobs[i].low - 1, jobs[i].high);
+    }
+    free(temp);
+#endif
+}
+
 void sample_callback(const char* message) {
     printf("Callback received: %s\n", message);
 }
@@ -507,6 +1458,10 @@ void demonstrate_functions(void) {
     }
     printf("\n");
     
+    // Fast path: table lookup instead of exponential recursion
+    printf("fibonacci_fast(40) = %llu\n", (unsigned long long)fibonacci_fast(40));
+    printf("fibonacci_iterative(90) = %llu\n", (unsigned long long)fibonacci_iterative(90));
+
     printf("Factorials:\n");
     for (int i = 1; i <= 5; i++) {
         printf("  %d! = %d\n", i, factorial(i));
@@ -523,12 +1478,23 @@ void demonstrate_functions(void) {
     printf("\n");
     
     bubble_sort(numbers, size);
-    
+
     printf("After sorting: ");
     for (int i = 0; i < size; i++) {
         printf("%d ", numbers[i]);
     }
     printf("\n");
+
+    // Hybrid sort: same signature, O(n log n) instead of O(n^2)
+    int more_numbers[] = {42, 7, 99, 1, 58, 23, 16, 4};
+    int more_size = sizeof(more_numbers) / sizeof(more_numbers[0]);
+    hybrid_sort(more_numbers, more_size);
+
+    printf("After hybrid sort: ");
+    for (int i = 0; i < more_size; i++) {
+        printf("%d ", more_numbers[i]);
+    }
+    printf("\n");
     
     // Callback function
     callback_example(sample_callback);
@@ -543,18 +1509,378 @@ char* safe_string_copy(char* dest, const char* src, size_t dest_size) {
     if (dest == NULL || src == NULL || dest_size == 0) {
         return NULL;
     }
-    
+
     strncpy(dest, src, dest_size - 1);
     dest[dest_size - 1] = '\0';
     return dest;
 }
 
+// Single-pass variant of safe_string_copy that returns the copied length,
+// so callers stop re-walking the result with strlen (strncpy also pads the
+// whole remainder of dest with zeros; this does not)
+size_t string_copy_len(char* dest, const char* src, size_t dest_size) {
+    if (dest == NULL || src == NULL || dest_size == 0) {
+        return 0;
+    }
+
+    size_t i = 0;
+    while (i < dest_size - 1 && src[i] != '\0') {
+        dest[i] = src[i];
+        i++;
+    }
+    dest[i] = '\0';
+    return i;
+}
+
+// memccpy-based implementation: the copy and the terminator scan are one
+// libc call, which gets to use word-wide copies internally
+size_t string_copy_memccpy(char* dest, const char* src, size_t dest_size) {
+    if (dest == NULL || src == NULL || dest_size == 0) {
+        return 0;
+    }
+
+    char* end = (char*)memccpy(dest, src, '\0', dest_size - 1);
+    if (end == NULL) {
+        // Source was truncated: terminate at the buffer edge
+        dest[dest_size - 1] = '\0';
+        return dest_size - 1;
+    }
+    return (size_t)(end - dest) - 1;
+}
+
+int stream_reader_open(StreamReader* reader, const char* path, size_t buffer_size) {
+    reader->file = fopen(path, "rb");
+    if (reader->file == NULL) {
+        return -1;
+    }
+    reader->buffer = (char*)malloc(buffer_size);
+    if (reader->buffer == NULL) {
+        fclose(reader->file);
+        reader->file = NULL;
+        return -1;
+    }
+    reader->buffer_size = buffer_size;
+    reader->data_len = 0;
+    reader->pos = 0;
+    reader->eof = false;
+    reader->mapped = false;
+    return 0;
+}
+
+// mmap read mode: the whole file becomes the buffer, so next_line never
+// copies or refills; falls back to the buffered path on non-POSIX builds
+int stream_reader_open_mapped(StreamReader* reader, const char* path) {
+#if defined(__unix__) || defined(__APPLE__)
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+        return -1;
+    }
+
+    void* mapping = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);   // The mapping keeps the file alive
+    if (mapping == MAP_FAILED) {
+        return -1;
+    }
+
+    reader->file = NULL;
+    reader->buffer = (char*)mapping;
+    reader->buffer_size = (size_t)info.st_size;
+    reader->data_len = (size_t)info.st_size;
+    reader->pos = 0;
+    reader->eof = true;
+    reader->mapped = true;
+    return 0;
+#else
+    return stream_reader_open(reader, path, 1 << 16);
+#endif
+}
+
+static bool stream_reader_refill(StreamReader* reader) {
+    if (reader->mapped || reader->eof) {
+        return false;
+    }
+
+    // Compact the unread tail to the front, then top the buffer up
+    size_t remaining = reader->data_len - reader->pos;
+    if (remaining == reader->buffer_size) {
+        // Buffer already full of one unterminated line: nothing to read
+        // yet, but this is not end-of-file — the caller drains a piece
+        // and the next refill has room to continue
+        return false;
+    }
+    memmove(reader->buffer, reader->buffer + reader->pos, remaining);
+    reader->pos = 0;
+    reader->data_len = remaining;
+
+    size_t got = fread(reader->buffer + remaining, 1,
+                       reader->buffer_size - remaining, reader->file);
+    if (got == 0) {
+        reader->eof = true;
+        return false;
+    }
+    INSTR_COUNT(file_reads);
+    reader->data_len += got;
+    return true;
+}
+
+// Iterator-style line access: returns a zero-copy slice (no per-line copy,
+// no NUL termination). Lines longer than the buffer are emitted in pieces.
+bool stream_reader_next_line(StreamReader* reader, LineSlice* line) {
+    while (1) {
+        const char* start = reader->buffer + reader->pos;
+        size_t remaining = reader->data_len - reader->pos;
+        const char* newline = (const char*)memchr(start, '\n', remaining);
+
+        if (newline != NULL) {
+            line->data = start;
+            line->length = (size_t)(newline - start);
+            reader->pos += line->length + 1;
+            return true;
+        }
+
+        if (!stream_reader_refill(reader)) {
+            // End of input: hand out whatever is left as the final line
+            start = reader->buffer + reader->pos;
+            remaining = reader->data_len - reader->pos;
+            if (remaining == 0) {
+                return false;
+            }
+            line->data = start;
+            line->length = remaining;
+            reader->pos = reader->data_len;
+            return true;
+        }
+    }
+}
+
+void stream_reader_close(StreamReader* reader) {
+    if (reader->mapped) {
+#if defined(__unix__) || defined(__APPLE__)
+        munmap(reader->buffer, reader->buffer_size);
+#endif
+    } else {
+        free(reader->buffer);
+    }
+    if (reader->file != NULL) {
+        fclose(reader->file);
+    }
+    reader->file = NULL;
+    reader->buffer = NULL;
+    reader->data_len = 0;
+    reader->pos = 0;
+}
+
+int stream_writer_open(StreamWriter* writer, const char* path, size_t buffer_size) {
+    writer->file = fopen(path, "wb");
+    if (writer->file == NULL) {
+        return -1;
+    }
+    writer->buffer = (char*)malloc(buffer_size);
+    if (writer->buffer == NULL) {
+        fclose(writer->file);
+        writer->file = NULL;
+        return -1;
+    }
+    writer->buffer_size = buffer_size;
+    writer->pos = 0;
+    return 0;
+}
+
+int stream_writer_flush(StreamWriter* writer) {
+    if (writer->pos > 0) {
+        if (fwrite(writer->buffer, 1, writer->pos, writer->file) != writer->pos) {
+            return -1;
+        }
+        writer->pos = 0;
+    }
+    return 0;
+}
+
+// Bytes accumulate in the user buffer and hit the FILE in large writes;
+// payloads bigger than the buffer bypass it entirely
+int stream_writer_write(StreamWriter* writer, const void* data, size_t length) {
+    if (length >= writer->buffer_size) {
+        if (stream_writer_flush(writer) != 0) {
+            return -1;
+        }
+        return (fwrite(data, 1, length, writer->file) == length) ? 0 : -1;
+    }
+    if (writer->pos + length > writer->buffer_size) {
+        if (stream_writer_flush(writer) != 0) {
+            return -1;
+        }
+    }
+    memcpy(writer->buffer + writer->pos, data, length);
+    writer->pos += length;
+    return 0;
+}
+
+void stream_writer_close(StreamWriter* writer) {
+    if (writer->file != NULL) {
+        stream_writer_flush(writer);
+        fclose(writer->file);
+    }
+    free(writer->buffer);
+    writer->file = NULL;
+    writer->buffer = NULL;
+    writer->pos = 0;
+}
+
+// --- Parallel file processing ---
+
+#define FILE_CHUNK_SIZE (1u << 16)   /* 64 KiB aligned blocks */
+#define FILE_MAX_WORKERS 8
+
+#if !defined(__STDC_NO_THREADS__)
+typedef struct FileChunkJob {
+    FileChunkFn chunk_fn;
+    const char* data;
+    size_t length;
+    uint64_t result;
+} FileChunkJob;
+
+static int file_chunk_job_run(void* arg) {
+    FileChunkJob* job = (FileChunkJob*)arg;
+    job->result = job->chunk_fn(job->data, job->length);
+    return 0;
+}
+#endif
+
+// Pipelined file processing: the file is read in batches of 64 KiB blocks,
+// each batch fans its blocks out to worker threads, and the main thread
+// fills the other buffer while the workers run — so I/O overlaps compute.
+// Chunk results are merged in file order once the batch joins. Builds
+// without C11 threads fall back to a serial chunk-at-a-time loop.
+int process_file_parallel(const char* path, FileChunkFn chunk_fn, FileMergeFn merge_fn, uint64_t* out_result) {
+    if (path == NULL || chunk_fn == NULL || merge_fn == NULL || out_result == NULL) {
+        return -1;
+    }
+
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        return -1;
+    }
+
+    uint64_t accumulated = 0;
+
+#if defined(__STDC_NO_THREADS__)
+    char* buffer = (char*)malloc(FILE_CHUNK_SIZE);
+    if (buffer == NULL) {
+        fclose(file);
+        return -1;
+    }
+    size_t got;
+    while ((got = fread(buffer, 1, FILE_CHUNK_SIZE, file)) > 0) {
+        INSTR_COUNT(file_reads);
+        accumulated = merge_fn(accumulated, chunk_fn(buffer, got));
+    }
+    free(buffer);
+#else
+    // Two batch buffers: workers process one while the reader fills the other
+    size_t batch_bytes = (size_t)FILE_CHUNK_SIZE * FILE_MAX_WORKERS;
+    char* buffers[2];
+    buffers[0] = (char*)malloc(batch_bytes);
+    buffers[1] = (char*)malloc(batch_bytes);
+    if (buffers[0] == NULL || buffers[1] == NULL) {
+        free(buffers[0]);
+        free(buffers[1]);
+        fclose(file);
+        return -1;
+    }
+
+    size_t filled[2];
+    int active = 0;
+    filled[0] = fread(buffers[0], 1, batch_bytes, file);
+    if (filled[0] > 0) {
+        INSTR_COUNT(file_reads);
+    }
+
+    while (filled[active] > 0) {
+        FileChunkJob jobs[FILE_MAX_WORKERS];
+        thrd_t threads[FILE_MAX_WORKERS];
+        bool started[FILE_MAX_WORKERS];
+        int n_jobs = 0;
+        size_t offset = 0;
+
+        // One worker per aligned block of the batch
+        while (offset < filled[active]) {
+            size_t length = filled[active] - offset;
+            if (length > FILE_CHUNK_SIZE) {
+                length = FILE_CHUNK_SIZE;
+            }
+            jobs[n_jobs].chunk_fn = chunk_fn;
+            jobs[n_jobs].data = buffers[active] + offset;
+            jobs[n_jobs].length = length;
+            jobs[n_jobs].result = 0;
+            started[n_jobs] = (thrd_create(&threads[n_jobs], file_chunk_job_run, &jobs[n_jobs]) == thrd_success);
+            if (!started[n_jobs]) {
+                file_chunk_job_run(&jobs[n_jobs]);   // Worker unavailable: process inline
+            }
+            offset += length;
+            n_jobs++;
+        }
+
+        // Overlap: read the next batch while the workers chew on this one
+        int next = 1 - active;
+        filled[next] = fread(buffers[next], 1, batch_bytes, file);
+        if (filled[next] > 0) {
+            INSTR_COUNT(file_reads);
+        }
+
+        for (int i = 0; i < n_jobs; i++) {
+            if (started[i]) {
+                thrd_join(threads[i], NULL);
+            }
+        }
+
+        // Jobs were cut front-to-back, so this merge preserves file order
+        for (int i = 0; i < n_jobs; i++) {
+            accumulated = merge_fn(accumulated, jobs[i].result);
+        }
+
+        active = next;
+    }
+
+    free(buffers[0]);
+    free(buffers[1]);
+#endif
+
+    fclose(file);
+    *out_result = accumulated;
+    return 0;
+}
+
+// Sample chunk reducer: newline count, safe to compute per block since a
+// newline never spans a block boundary
+uint64_t count_newlines_chunk(const char* data, size_t length) {
+    uint64_t count = 0;
+    const char* cursor = data;
+    const char* end = data + length;
+    while ((cursor = (const char*)memchr(cursor, '\n', (size_t)(end - cursor))) != NULL) {
+        count++;
+        cursor++;
+    }
+    return count;
+}
+
+uint64_t sum_chunk_results(uint64_t accumulated, uint64_t chunk_result) {
+    return accumulated + chunk_result;
+}
+
 void demonstrate_file_operations(void) {
     printf("\n--- File Operations Demonstration ---\n");
-    
+
     const char* filename = "test_output.txt";
     FILE* file;
-    
+
+    INSTR_TIMER_START(io_start);
+
     // Write to file
     file = fopen(filename, "w");
     if (file != NULL) {
@@ -563,12 +1889,13 @@ void demonstrate_file_operations(void) {
         fprintf(file, "Number: %d\n", 42);
         fprintf(file, "Float: %.2f\n", 3.14159);
         fclose(file);
+        INSTR_COUNT(file_writes);
         printf("Successfully wrote to %s\n", filename);
     } else {
         printf("Failed to open %s for writing\n", filename);
         return;
     }
-    
+
     // Read from file
     file = fopen(filename, "r");
     if (file != NULL) {
@@ -578,18 +1905,99 @@ void demonstrate_file_operations(void) {
             printf("  %s", buffer);
         }
         fclose(file);
+        INSTR_COUNT(file_reads);
     } else {
         printf("Failed to open %s for reading\n", filename);
     }
     
+    // Streaming re-read: one big buffered read, zero-copy line slices
+    StreamReader reader;
+    if (stream_reader_open(&reader, filename, 1 << 16) == 0) {
+        LineSlice line;
+        printf("Streaming read of %s:\n", filename);
+        while (stream_reader_next_line(&reader, &line)) {
+            printf("  %.*s\n", (int)line.length, line.data);
+        }
+        stream_reader_close(&reader);
+    }
+
+    // Pipelined re-read: chunked blocks fan out to workers, results merge
+    // in file order
+    uint64_t line_count = 0;
+    if (process_file_parallel(filename, count_newlines_chunk, sum_chunk_results, &line_count) == 0) {
+        printf("Parallel line count of %s: %llu\n", filename, (unsigned long long)line_count);
+    }
+
     // Remove the test file
     if (remove(filename) == 0) {
         printf("Successfully removed %s\n", filename);
     } else {
         printf("Failed to remove %s\n", filename);
     }
+
+    INSTR_TIMER_STOP(io_start);
+}
+
+// Benchmark harness for the C hot paths; gated behind a macro since this
+// tree has no build manifest to hang a separate target on. Compile with
+// -DENABLE_BENCHMARKS and it runs at the end of main, printing JSON lines.
+#ifdef ENABLE_BENCHMARKS
+static double bench_elapsed_ns(const struct timespec* start, const struct timespec* end) {
+    return (double)(end->tv_sec - start->tv_sec) * 1e9 +
+           (double)(end->tv_nsec - start->tv_nsec);
 }
 
+static void bench_report(const char* name, int input_size, double ns_per_op) {
+    printf("{\"name\": \"%s\", \"input_size\": %d, \"ns_per_op\": %.1f}\n",
+           name, input_size, ns_per_op);
+}
+
+void run_benchmarks(void) {
+    struct timespec start, end;
+    const int sizes[] = {1024, 16384};
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        int n = sizes[s];
+        int* data = (int*)malloc((size_t)n * sizeof(int));
+        if (data == NULL) {
+            return;
+        }
+
+        // bubble_sort baseline vs hybrid_sort replacement
+        for (int i = 0; i < n; i++) {
+            data[i] = (int)((unsigned)i * 2654435761u) % n;
+        }
+        timespec_get(&start, TIME_UTC);
+        bubble_sort(data, n);
+        timespec_get(&end, TIME_UTC);
+        bench_report("bubble_sort", n, bench_elapsed_ns(&start, &end));
+
+        for (int i = 0; i < n; i++) {
+            data[i] = (int)((unsigned)i * 2654435761u) % n;
+        }
+        timespec_get(&start, TIME_UTC);
+        hybrid_sort(data, n);
+        timespec_get(&end, TIME_UTC);
+        bench_report("hybrid_sort", n, bench_elapsed_ns(&start, &end));
+
+        free(data);
+    }
+
+    // Recursive fibonacci vs the table-backed fast path
+    timespec_get(&start, TIME_UTC);
+    volatile int fib_slow = fibonacci(30);
+    timespec_get(&end, TIME_UTC);
+    (void)fib_slow;
+    bench_report("fibonacci_recursive", 30, bench_elapsed_ns(&start, &end));
+
+    timespec_get(&start, TIME_UTC);
+    volatile uint64_t fib_fast = fibonacci_fast(30);
+    timespec_get(&end, TIME_UTC);
+    (void)fib_fast;
+    bench_report("fibonacci_fast", 30, bench_elapsed_ns(&start, &end));
+}
+#endif // ENABLE_BENCHMARKS
+
 // Main function
 int main(int argc, char* argv[]) {
     // Print command line arguments
@@ -689,9 +2097,98 @@ int main(int argc, char* argv[]) {
         printf("\nDistance between %s and %s: %.2f units\n", 
                person1->name, person2->name, distance);
         
+        // Snapshot the list, then reopen it mapped and read records in place
+        person1->next = person2;
+        if (person_snapshot_write(person1, "persons.snap") == 0) {
+            PersonSnapshot snapshot;
+            if (person_snapshot_open(&snapshot, "persons.snap") == 0) {
+                printf("\nSnapshot holds %u records; first: %s (age %d)\n",
+                       snapshot.header->record_count,
+                       snapshot.records[0].name, snapshot.records[0].age);
+                person_snapshot_close(&snapshot);
+            }
+            remove("persons.snap");
+        }
+        person1->next = NULL;   // Unlink so the frees below stay independent
+
         free_person(person1);
         free_person(person2);
     }
+
+    // Arena-backed persons: one malloc up front, one reset to free the batch
+    Arena person_arena;
+    if (arena_init(&person_arena, 16 * sizeof(Person)) == 0) {
+        Person* batch_head = create_person_in(&person_arena, "Carol White", 41, "carol@example.com");
+        if (batch_head != NULL) {
+            batch_head->next = create_person_in(&person_arena, "Dave Green", 35, "dave@example.com");
+            printf("\nArena-backed person:\n");
+            print_person(batch_head);
+        }
+        arena_reset(&person_arena);   // Frees the whole batch in O(1)
+        arena_destroy(&person_arena);
+    }
+
+    // Radix key sort: ages sort through packed 8-byte keys, no comparator
+    Person people_by_age[3] = {
+        {.name = "Zoe", .age = 50},
+        {.name = "Amy", .age = 22},
+        {.name = "Max", .age = 37}
+    };
+    sort_persons_by_age(people_by_age, 3);
+    printf("\nSorted by age:");
+    for (int i = 0; i < 3; i++) {
+        printf(" %s(%d)", people_by_age[i].name, people_by_age[i].age);
+    }
+    printf("\n");
+
+    // Interned person records: shared strings, integer equality
+    InternTable names;
+    intern_table_init(&names);
+    CompactPerson compact1 = create_compact_person(&names, "Alice Smith", 30, "alice@example.com");
+    CompactPerson compact2 = create_compact_person(&names, "Alice Smith", 31, "alice@example.com");
+    if (compact1.name_id == compact2.name_id) {
+        printf("\nSame interned name '%s' (table holds %u strings, "
+               "%zu bytes per compact record)\n",
+               intern_lookup(&names, compact1.name_id), names.count,
+               sizeof(CompactPerson));
+    }
+    intern_table_destroy(&names);
+
+    // Pool-backed person list: contiguous nodes, 32-bit index links
+    PersonPool pool;
+    if (person_pool_init(&pool, 4) == 0) {
+        uint32_t head = person_pool_create(&pool, "Erin Black", 29, "erin@example.com");
+        uint32_t second = person_pool_create(&pool, "Frank Gray", 52, "frank@example.com");
+        if (head != PERSON_POOL_NIL && second != PERSON_POOL_NIL) {
+            person_pool_get(&pool, head)->next_index = second;
+
+            printf("\nPooled person chain:");
+            for (uint32_t idx = head; idx != PERSON_POOL_NIL;
+                 idx = person_pool_get(&pool, idx)->next_index) {
+                printf(" %s(%d)", person_pool_get(&pool, idx)->name,
+                       person_pool_get(&pool, idx)->age);
+            }
+            printf("\n");
+        }
+        person_pool_destroy(&pool);
+    }
+
+    // Structure-of-arrays point math: one kernel call per batch
+    PointBatch batch_a, batch_b;
+    if (point_batch_init(&batch_a, 4) == 0 && point_batch_init(&batch_b, 4) == 0) {
+        double distances[4];
+        for (size_t i = 0; i < 4; i++) {
+            batch_a.xs[i] = (double)i;
+            batch_a.ys[i] = (double)i;
+            batch_b.xs[i] = 0.0;
+            batch_b.ys[i] = 0.0;
+        }
+        distance_batch(&batch_a, &batch_b, distances);
+        printf("\nBatch distances: %.2f %.2f %.2f %.2f\n",
+               distances[0], distances[1], distances[2], distances[3]);
+        point_batch_destroy(&batch_a);
+        point_batch_destroy(&batch_b);
+    }
     
     // Union demonstration
     Number num;
@@ -778,7 +2275,13 @@ int main(int argc, char* argv[]) {
     printf("floor(3.8) = %.0f\n", floor(3.8));
     
     printf("\nC syntax test completed successfully!\n");
-    
+
+#ifdef ENABLE_BENCHMARKS
+    run_benchmarks();
+#endif
+
+    INSTR_REPORT();
+
     return EXIT_SUCCESS;
 }
 
@@ -809,6 +2312,130 @@ void print_matrix(int rows, int cols, int matrix[rows][cols]) {
     }
 }
 
+// --- Cache-blocked matrix module ---
+// Same VLA/row-major layout as print_matrix, but the kernels walk the data
+// in tiles sized to stay resident in L1/L2 instead of streaming whole rows
+
+#define MATRIX_TILE 64
+
+static int min_int(int a, int b) {
+    return (a < b) ? a : b;
+}
+
+// Tiled transpose: reads and writes both touch one small block at a time,
+// so neither side of the copy thrashes the cache on large matrices
+void matrix_transpose_blocked(int rows, int cols, int src[rows][cols], int dst[cols][rows]) {
+    for (int ii = 0; ii < rows; ii += MATRIX_TILE) {
+        for (int jj = 0; jj < cols; jj += MATRIX_TILE) {
+            int i_end = min_int(ii + MATRIX_TILE, rows);
+            int j_end = min_int(jj + MATRIX_TILE, cols);
+            for (int i = ii; i < i_end; i++) {
+                for (int j = jj; j < j_end; j++) {
+                    dst[j][i] = src[i][j];
+                }
+            }
+        }
+    }
+}
+
+// One row-block of a tiled multiply over flat row-major storage; shared by
+// the serial and the threaded entry points. The i-k-j inner ordering keeps
+// the b tile streaming sequentially.
+static void matmul_row_block(const int* a, const int* b, int* c,
+                             int n, int m, int p, int ii) {
+    int i_end = min_int(ii + MATRIX_TILE, n);
+    for (int i = ii; i < i_end; i++) {
+        for (int j = 0; j < p; j++) {
+            c[i * p + j] = 0;
+        }
+    }
+    for (int kk = 0; kk < m; kk += MATRIX_TILE) {
+        for (int jj = 0; jj < p; jj += MATRIX_TILE) {
+            int k_end = min_int(kk + MATRIX_TILE, m);
+            int j_end = min_int(jj + MATRIX_TILE, p);
+            for (int i = ii; i < i_end; i++) {
+                for (int k = kk; k < k_end; k++) {
+                    int a_ik = a[i * m + k];
+                    for (int j = jj; j < j_end; j++) {
+                        c[i * p + j] += a_ik * b[k * p + j];
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Cache-blocked multiply: c = a x b with all three loops tiled
+void matrix_multiply_blocked(int n, int m, int p, int a[n][m], int b[m][p], int c[n][p]) {
+    for (int ii = 0; ii < n; ii += MATRIX_TILE) {
+        matmul_row_block(&a[0][0], &b[0][0], &c[0][0], n, m, p, ii);
+    }
+}
+
+#if !defined(__STDC_NO_THREADS__)
+typedef struct MatMulJob {
+    const int* a;
+    const int* b;
+    int* c;
+    int n, m, p;
+    int thread_index;
+    int thread_count;
+} MatMulJob;
+
+// Static tile schedule: worker t takes every thread_count-th row block, so
+// no queue or lock is needed and the blocks never overlap
+static int matmul_job_run(void* arg) {
+    MatMulJob* job = (MatMulJob*)arg;
+    for (int ii = job->thread_index * MATRIX_TILE; ii < job->n;
+         ii += job->thread_count * MATRIX_TILE) {
+        matmul_row_block(job->a, job->b, job->c, job->n, job->m, job->p, ii);
+    }
+    return 0;
+}
+#endif
+
+// Threaded multiply: row blocks fan out across workers; serial fallback
+// for small matrices or builds without C11 threads
+void matrix_multiply_parallel(int n, int m, int p, int a[n][m], int b[m][p], int c[n][p],
+                              int n_threads) {
+#if defined(__STDC_NO_THREADS__)
+    (void)n_threads;
+    matrix_multiply_blocked(n, m, p, a, b, c);
+#else
+    if (n_threads < 2 || n < 2 * MATRIX_TILE) {
+        matrix_multiply_blocked(n, m, p, a, b, c);
+        return;
+    }
+    if (n_threads > SORT_MAX_THREADS) {
+        n_threads = SORT_MAX_THREADS;
+    }
+
+    MatMulJob jobs[SORT_MAX_THREADS];
+    thrd_t threads[SORT_MAX_THREADS];
+    bool started[SORT_MAX_THREADS];
+
+    for (int t = 0; t < n_threads; t++) {
+        jobs[t].a = &a[0][0];
+        jobs[t].b = &b[0][0];
+        jobs[t].c = &c[0][0];
+        jobs[t].n = n;
+        jobs[t].m = m;
+        jobs[t].p = p;
+        jobs[t].thread_index = t;
+        jobs[t].thread_count = n_threads;
+        started[t] = (thrd_create(&threads[t], matmul_job_run, &jobs[t]) == thrd_success);
+        if (!started[t]) {
+            matmul_job_run(&jobs[t]);
+        }
+    }
+    for (int t = 0; t < n_threads; t++) {
+        if (started[t]) {
+            thrd_join(threads[t], NULL);
+        }
+    }
+#endif
+}
+
 // Designated initializers (C99)
 void demonstrate_designated_initializers(void) {
     struct Point points[] = {